@@ -0,0 +1,120 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cubool/CMakeLists.txt"
+  "/root/repo/cubool/tests/CMakeLists.txt"
+  "/root/repo/deps/gtest/CMakeLists.txt"
+  "/root/repo/deps/gtest/googlemock/CMakeLists.txt"
+  "/root/repo/deps/gtest/googlemock/cmake/gmock.pc.in"
+  "/root/repo/deps/gtest/googlemock/cmake/gmock_main.pc.in"
+  "/root/repo/deps/gtest/googletest/CMakeLists.txt"
+  "/root/repo/deps/gtest/googletest/cmake/Config.cmake.in"
+  "/root/repo/deps/gtest/googletest/cmake/gtest.pc.in"
+  "/root/repo/deps/gtest/googletest/cmake/gtest_main.pc.in"
+  "/root/repo/deps/gtest/googletest/cmake/internal_utils.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "deps/gtest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "deps/gtest/googletest/generated/gmock.pc"
+  "deps/gtest/googletest/generated/gmock_main.pc"
+  "deps/gtest/googlemock/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "deps/gtest/googletest/generated/GTestConfigVersion.cmake"
+  "deps/gtest/googletest/generated/GTestConfig.cmake"
+  "deps/gtest/googletest/generated/gtest.pc"
+  "deps/gtest/googletest/generated/gtest_main.pc"
+  "deps/gtest/googletest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "cubool/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "cubool/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "deps/gtest/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "deps/gtest/googlemock/CMakeFiles/gmock_main.dir/DependInfo.cmake"
+  "deps/gtest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "deps/gtest/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "cubool/CMakeFiles/cubool.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_library_api.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_matrix_setup.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_matrix_element.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_matrix_misc.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_matrix_transpose.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_matrix_sub_matrix.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_matrix_extract_vector.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_matrix_reduce.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_matrix_mxm.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_matrix_mxm_masked.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_matrix_closure.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_matrix_kronecker.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_matrix_ewiseadd.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_matrix_ewisemult.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_matrix_ewisediff.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_matrix_format.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_matrix_csr.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_matrix_mtx.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_matrix_binary.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_matrix_builder.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_matrix_offsets.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_vector_misc.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_vector_element.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_vector_ewiseadd.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_vector_ewisemult.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_vector_ewisediff.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_vector_mxv.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_vector_mxv_masked.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_vector_vxm.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_vector_vxm_masked.dir/DependInfo.cmake"
+  "cubool/tests/CMakeFiles/test_vector_sub_vector.dir/DependInfo.cmake"
+  )
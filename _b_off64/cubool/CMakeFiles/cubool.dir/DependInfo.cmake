@@ -0,0 +1,124 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cubool/sources/core/library.cpp" "cubool/CMakeFiles/cubool.dir/sources/core/library.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/core/library.cpp.o.d"
+  "/root/repo/cubool/sources/core/matrix.cpp" "cubool/CMakeFiles/cubool.dir/sources/core/matrix.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/core/matrix.cpp.o.d"
+  "/root/repo/cubool/sources/core/matrix_builder.cpp" "cubool/CMakeFiles/cubool.dir/sources/core/matrix_builder.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/core/matrix_builder.cpp.o.d"
+  "/root/repo/cubool/sources/core/object.cpp" "cubool/CMakeFiles/cubool.dir/sources/core/object.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/core/object.cpp.o.d"
+  "/root/repo/cubool/sources/core/vector.cpp" "cubool/CMakeFiles/cubool.dir/sources/core/vector.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/core/vector.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Finalize.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Finalize.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Finalize.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_GetAbout.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_GetAbout.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_GetAbout.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_GetDeviceCaps.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_GetDeviceCaps.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_GetDeviceCaps.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_GetLicenseInfo.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_GetLicenseInfo.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_GetLicenseInfo.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_GetVersion.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_GetVersion.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_GetVersion.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Initialize.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Initialize.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Initialize.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Kronecker.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Kronecker.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Kronecker.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Kronecker_Delta.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Kronecker_Delta.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Kronecker_Delta.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_MatrixBuilder_AppendPairs.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_MatrixBuilder_AppendPairs.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_MatrixBuilder_AppendPairs.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_MatrixBuilder_Finish.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_MatrixBuilder_Finish.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_MatrixBuilder_Finish.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_MatrixBuilder_Free.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_MatrixBuilder_Free.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_MatrixBuilder_Free.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_MatrixBuilder_New.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_MatrixBuilder_New.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_MatrixBuilder_New.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_Build.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Build.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Build.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_BuildCsr.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_BuildCsr.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_BuildCsr.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_Duplicate.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Duplicate.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Duplicate.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_EWiseAdd.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_EWiseAdd.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_EWiseAdd.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_EWiseAdd_Delta.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_EWiseAdd_Delta.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_EWiseAdd_Delta.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_EWiseDiff.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_EWiseDiff.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_EWiseDiff.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_EWiseMult.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_EWiseMult.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_EWiseMult.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_ExportCsr.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExportCsr.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExportCsr.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_ExportMtx.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExportMtx.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExportMtx.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_ExtractCol.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExtractCol.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExtractCol.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_ExtractPairs.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExtractPairs.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExtractPairs.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_ExtractRow.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExtractRow.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExtractRow.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_ExtractSubMatrix.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExtractSubMatrix.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExtractSubMatrix.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_Free.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Free.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Free.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_ImportMtx.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_ImportMtx.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_ImportMtx.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_Load.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Load.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Load.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_Marker.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Marker.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Marker.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_Ncols.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Ncols.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Ncols.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_New.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_New.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_New.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_Nrows.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Nrows.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Nrows.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_Nvals.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Nvals.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Nvals.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_Reduce.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Reduce.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Reduce.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_Reduce2.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Reduce2.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Reduce2.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_Save.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Save.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Save.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_SetElement.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_SetElement.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_SetElement.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_SetFormat.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_SetFormat.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_SetFormat.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_SetMarker.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_SetMarker.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_SetMarker.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_TransitiveClosure.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_TransitiveClosure.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_TransitiveClosure.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Matrix_Transpose.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Transpose.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Matrix_Transpose.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_MxM.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_MxM.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_MxM.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_MxM_Delta.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_MxM_Delta.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_MxM_Delta.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_MxM_Masked.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_MxM_Masked.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_MxM_Masked.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_MxV.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_MxV.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_MxV.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_MxV_Masked.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_MxV_Masked.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_MxV_Masked.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_SetupLogger.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_SetupLogger.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_SetupLogger.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_SetupThreads.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_SetupThreads.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_SetupThreads.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Vector_Build.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_Build.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_Build.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Vector_Duplicate.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_Duplicate.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_Duplicate.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Vector_EWiseAdd.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_EWiseAdd.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_EWiseAdd.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Vector_EWiseDiff.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_EWiseDiff.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_EWiseDiff.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Vector_EWiseMult.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_EWiseMult.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_EWiseMult.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Vector_ExtractSubVector.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_ExtractSubVector.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_ExtractSubVector.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Vector_ExtractValues.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_ExtractValues.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_ExtractValues.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Vector_Free.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_Free.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_Free.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Vector_Marker.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_Marker.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_Marker.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Vector_New.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_New.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_New.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Vector_Nrows.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_Nrows.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_Nrows.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Vector_Nvals.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_Nvals.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_Nvals.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Vector_Reduce.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_Reduce.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_Reduce.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Vector_SetElement.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_SetElement.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_SetElement.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_Vector_SetMarker.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_SetMarker.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_Vector_SetMarker.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_VxM.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_VxM.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_VxM.cpp.o.d"
+  "/root/repo/cubool/sources/cuBool_VxM_Masked.cpp" "cubool/CMakeFiles/cubool.dir/sources/cuBool_VxM_Masked.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/cuBool_VxM_Masked.cpp.o.d"
+  "/root/repo/cubool/sources/io/binary_io.cpp" "cubool/CMakeFiles/cubool.dir/sources/io/binary_io.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/io/binary_io.cpp.o.d"
+  "/root/repo/cubool/sources/io/logger.cpp" "cubool/CMakeFiles/cubool.dir/sources/io/logger.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/io/logger.cpp.o.d"
+  "/root/repo/cubool/sources/io/mapped_file.cpp" "cubool/CMakeFiles/cubool.dir/sources/io/mapped_file.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/io/mapped_file.cpp.o.d"
+  "/root/repo/cubool/sources/io/mtx_io.cpp" "cubool/CMakeFiles/cubool.dir/sources/io/mtx_io.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/io/mtx_io.cpp.o.d"
+  "/root/repo/cubool/sources/parallel/pl_backend.cpp" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_backend.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_backend.cpp.o.d"
+  "/root/repo/cubool/sources/parallel/pl_build.cpp" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_build.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_build.cpp.o.d"
+  "/root/repo/cubool/sources/parallel/pl_ewiseadd.cpp" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_ewiseadd.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_ewiseadd.cpp.o.d"
+  "/root/repo/cubool/sources/parallel/pl_ewisediff.cpp" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_ewisediff.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_ewisediff.cpp.o.d"
+  "/root/repo/cubool/sources/parallel/pl_ewisemult.cpp" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_ewisemult.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_ewisemult.cpp.o.d"
+  "/root/repo/cubool/sources/parallel/pl_kronecker.cpp" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_kronecker.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_kronecker.cpp.o.d"
+  "/root/repo/cubool/sources/parallel/pl_matrix.cpp" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_matrix.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_matrix.cpp.o.d"
+  "/root/repo/cubool/sources/parallel/pl_spgemm.cpp" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_spgemm.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_spgemm.cpp.o.d"
+  "/root/repo/cubool/sources/parallel/pl_spgemm_masked.cpp" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_spgemm_masked.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_spgemm_masked.cpp.o.d"
+  "/root/repo/cubool/sources/parallel/pl_spgemv.cpp" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_spgemv.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_spgemv.cpp.o.d"
+  "/root/repo/cubool/sources/parallel/pl_thread_pool.cpp" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_thread_pool.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_thread_pool.cpp.o.d"
+  "/root/repo/cubool/sources/parallel/pl_vector.cpp" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_vector.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/parallel/pl_vector.cpp.o.d"
+  "/root/repo/cubool/sources/sequential/sq_backend.cpp" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_backend.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_backend.cpp.o.d"
+  "/root/repo/cubool/sources/sequential/sq_bitmap.cpp" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_bitmap.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_bitmap.cpp.o.d"
+  "/root/repo/cubool/sources/sequential/sq_dcsr.cpp" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_dcsr.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_dcsr.cpp.o.d"
+  "/root/repo/cubool/sources/sequential/sq_ewiseadd.cpp" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_ewiseadd.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_ewiseadd.cpp.o.d"
+  "/root/repo/cubool/sources/sequential/sq_ewisediff.cpp" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_ewisediff.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_ewisediff.cpp.o.d"
+  "/root/repo/cubool/sources/sequential/sq_ewisemult.cpp" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_ewisemult.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_ewisemult.cpp.o.d"
+  "/root/repo/cubool/sources/sequential/sq_kronecker.cpp" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_kronecker.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_kronecker.cpp.o.d"
+  "/root/repo/cubool/sources/sequential/sq_matrix.cpp" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_matrix.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_matrix.cpp.o.d"
+  "/root/repo/cubool/sources/sequential/sq_pack.cpp" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_pack.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_pack.cpp.o.d"
+  "/root/repo/cubool/sources/sequential/sq_reduce.cpp" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_reduce.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_reduce.cpp.o.d"
+  "/root/repo/cubool/sources/sequential/sq_roar.cpp" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_roar.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_roar.cpp.o.d"
+  "/root/repo/cubool/sources/sequential/sq_spgemm.cpp" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_spgemm.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_spgemm.cpp.o.d"
+  "/root/repo/cubool/sources/sequential/sq_spgemm_masked.cpp" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_spgemm_masked.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_spgemm_masked.cpp.o.d"
+  "/root/repo/cubool/sources/sequential/sq_spgemv.cpp" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_spgemv.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_spgemv.cpp.o.d"
+  "/root/repo/cubool/sources/sequential/sq_spgemv_masked.cpp" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_spgemv_masked.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_spgemv_masked.cpp.o.d"
+  "/root/repo/cubool/sources/sequential/sq_submatrix.cpp" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_submatrix.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_submatrix.cpp.o.d"
+  "/root/repo/cubool/sources/sequential/sq_subvector.cpp" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_subvector.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_subvector.cpp.o.d"
+  "/root/repo/cubool/sources/sequential/sq_transpose.cpp" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_transpose.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_transpose.cpp.o.d"
+  "/root/repo/cubool/sources/sequential/sq_vector.cpp" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_vector.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/sequential/sq_vector.cpp.o.d"
+  "/root/repo/cubool/sources/utils/data_utils.cpp" "cubool/CMakeFiles/cubool.dir/sources/utils/data_utils.cpp.o" "gcc" "cubool/CMakeFiles/cubool.dir/sources/utils/data_utils.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,221 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cubool.dir/sources/core/library.cpp.o"
+  "CMakeFiles/cubool.dir/sources/core/library.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/core/matrix.cpp.o"
+  "CMakeFiles/cubool.dir/sources/core/matrix.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/core/matrix_builder.cpp.o"
+  "CMakeFiles/cubool.dir/sources/core/matrix_builder.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/core/object.cpp.o"
+  "CMakeFiles/cubool.dir/sources/core/object.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/core/vector.cpp.o"
+  "CMakeFiles/cubool.dir/sources/core/vector.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Finalize.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Finalize.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_GetAbout.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_GetAbout.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_GetDeviceCaps.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_GetDeviceCaps.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_GetLicenseInfo.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_GetLicenseInfo.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_GetVersion.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_GetVersion.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Initialize.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Initialize.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Kronecker.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Kronecker.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Kronecker_Delta.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Kronecker_Delta.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_MatrixBuilder_AppendPairs.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_MatrixBuilder_AppendPairs.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_MatrixBuilder_Finish.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_MatrixBuilder_Finish.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_MatrixBuilder_Free.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_MatrixBuilder_Free.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_MatrixBuilder_New.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_MatrixBuilder_New.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Build.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Build.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_BuildCsr.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_BuildCsr.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Duplicate.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Duplicate.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_EWiseAdd.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_EWiseAdd.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_EWiseAdd_Delta.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_EWiseAdd_Delta.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_EWiseDiff.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_EWiseDiff.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_EWiseMult.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_EWiseMult.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExportCsr.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExportCsr.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExportMtx.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExportMtx.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExtractCol.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExtractCol.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExtractPairs.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExtractPairs.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExtractRow.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExtractRow.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExtractSubMatrix.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_ExtractSubMatrix.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Free.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Free.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_ImportMtx.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_ImportMtx.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Load.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Load.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Marker.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Marker.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Ncols.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Ncols.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_New.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_New.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Nrows.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Nrows.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Nvals.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Nvals.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Reduce.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Reduce.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Reduce2.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Reduce2.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Save.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Save.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_SetElement.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_SetElement.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_SetFormat.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_SetFormat.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_SetMarker.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_SetMarker.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_TransitiveClosure.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_TransitiveClosure.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Transpose.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Matrix_Transpose.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_MxM.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_MxM.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_MxM_Delta.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_MxM_Delta.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_MxM_Masked.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_MxM_Masked.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_MxV.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_MxV.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_MxV_Masked.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_MxV_Masked.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_SetupLogger.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_SetupLogger.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_SetupThreads.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_SetupThreads.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_Build.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_Build.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_Duplicate.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_Duplicate.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_EWiseAdd.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_EWiseAdd.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_EWiseDiff.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_EWiseDiff.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_EWiseMult.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_EWiseMult.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_ExtractSubVector.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_ExtractSubVector.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_ExtractValues.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_ExtractValues.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_Free.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_Free.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_Marker.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_Marker.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_New.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_New.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_Nrows.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_Nrows.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_Nvals.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_Nvals.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_Reduce.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_Reduce.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_SetElement.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_SetElement.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_SetMarker.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_Vector_SetMarker.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_VxM.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_VxM.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/cuBool_VxM_Masked.cpp.o"
+  "CMakeFiles/cubool.dir/sources/cuBool_VxM_Masked.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/io/binary_io.cpp.o"
+  "CMakeFiles/cubool.dir/sources/io/binary_io.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/io/logger.cpp.o"
+  "CMakeFiles/cubool.dir/sources/io/logger.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/io/mapped_file.cpp.o"
+  "CMakeFiles/cubool.dir/sources/io/mapped_file.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/io/mtx_io.cpp.o"
+  "CMakeFiles/cubool.dir/sources/io/mtx_io.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_backend.cpp.o"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_backend.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_build.cpp.o"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_build.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_ewiseadd.cpp.o"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_ewiseadd.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_ewisediff.cpp.o"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_ewisediff.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_ewisemult.cpp.o"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_ewisemult.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_kronecker.cpp.o"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_kronecker.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_matrix.cpp.o"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_matrix.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_spgemm.cpp.o"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_spgemm.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_spgemm_masked.cpp.o"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_spgemm_masked.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_spgemv.cpp.o"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_spgemv.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_thread_pool.cpp.o"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_thread_pool.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_vector.cpp.o"
+  "CMakeFiles/cubool.dir/sources/parallel/pl_vector.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_backend.cpp.o"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_backend.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_bitmap.cpp.o"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_bitmap.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_dcsr.cpp.o"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_dcsr.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_ewiseadd.cpp.o"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_ewiseadd.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_ewisediff.cpp.o"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_ewisediff.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_ewisemult.cpp.o"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_ewisemult.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_kronecker.cpp.o"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_kronecker.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_matrix.cpp.o"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_matrix.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_pack.cpp.o"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_pack.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_reduce.cpp.o"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_reduce.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_roar.cpp.o"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_roar.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_spgemm.cpp.o"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_spgemm.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_spgemm_masked.cpp.o"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_spgemm_masked.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_spgemv.cpp.o"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_spgemv.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_spgemv_masked.cpp.o"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_spgemv_masked.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_submatrix.cpp.o"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_submatrix.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_subvector.cpp.o"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_subvector.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_transpose.cpp.o"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_transpose.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_vector.cpp.o"
+  "CMakeFiles/cubool.dir/sources/sequential/sq_vector.cpp.o.d"
+  "CMakeFiles/cubool.dir/sources/utils/data_utils.cpp.o"
+  "CMakeFiles/cubool.dir/sources/utils/data_utils.cpp.o.d"
+  "libcubool.pdb"
+  "libcubool.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cubool.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_library_api.dir/test_library_api.cpp.o"
+  "CMakeFiles/test_library_api.dir/test_library_api.cpp.o.d"
+  "test_library_api"
+  "test_library_api.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_library_api.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_matrix_binary.dir/test_matrix_binary.cpp.o"
+  "CMakeFiles/test_matrix_binary.dir/test_matrix_binary.cpp.o.d"
+  "test_matrix_binary"
+  "test_matrix_binary.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_binary.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_matrix_builder.dir/test_matrix_builder.cpp.o"
+  "CMakeFiles/test_matrix_builder.dir/test_matrix_builder.cpp.o.d"
+  "test_matrix_builder"
+  "test_matrix_builder.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_builder.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
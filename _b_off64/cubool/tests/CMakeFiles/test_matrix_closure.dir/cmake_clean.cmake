@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_matrix_closure.dir/test_matrix_closure.cpp.o"
+  "CMakeFiles/test_matrix_closure.dir/test_matrix_closure.cpp.o.d"
+  "test_matrix_closure"
+  "test_matrix_closure.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_closure.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cubool/tests/test_matrix_csr.cpp" "cubool/tests/CMakeFiles/test_matrix_csr.dir/test_matrix_csr.cpp.o" "gcc" "cubool/tests/CMakeFiles/test_matrix_csr.dir/test_matrix_csr.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_b_off64/cubool/CMakeFiles/cubool.dir/DependInfo.cmake"
+  "/root/repo/_b_off64/deps/gtest/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
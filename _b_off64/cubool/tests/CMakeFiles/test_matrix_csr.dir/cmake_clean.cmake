@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_matrix_csr.dir/test_matrix_csr.cpp.o"
+  "CMakeFiles/test_matrix_csr.dir/test_matrix_csr.cpp.o.d"
+  "test_matrix_csr"
+  "test_matrix_csr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_csr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_matrix_element.dir/test_matrix_element.cpp.o"
+  "CMakeFiles/test_matrix_element.dir/test_matrix_element.cpp.o.d"
+  "test_matrix_element"
+  "test_matrix_element.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_element.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_matrix_ewiseadd.dir/test_matrix_ewiseadd.cpp.o"
+  "CMakeFiles/test_matrix_ewiseadd.dir/test_matrix_ewiseadd.cpp.o.d"
+  "test_matrix_ewiseadd"
+  "test_matrix_ewiseadd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_ewiseadd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_matrix_ewisediff.dir/test_matrix_ewisediff.cpp.o"
+  "CMakeFiles/test_matrix_ewisediff.dir/test_matrix_ewisediff.cpp.o.d"
+  "test_matrix_ewisediff"
+  "test_matrix_ewisediff.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_ewisediff.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_matrix_ewisemult.dir/test_matrix_ewisemult.cpp.o"
+  "CMakeFiles/test_matrix_ewisemult.dir/test_matrix_ewisemult.cpp.o.d"
+  "test_matrix_ewisemult"
+  "test_matrix_ewisemult.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_ewisemult.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_matrix_extract_vector.dir/test_matrix_extract_vector.cpp.o"
+  "CMakeFiles/test_matrix_extract_vector.dir/test_matrix_extract_vector.cpp.o.d"
+  "test_matrix_extract_vector"
+  "test_matrix_extract_vector.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_extract_vector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_matrix_format.dir/test_matrix_format.cpp.o"
+  "CMakeFiles/test_matrix_format.dir/test_matrix_format.cpp.o.d"
+  "test_matrix_format"
+  "test_matrix_format.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_format.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_matrix_kronecker.dir/test_matrix_kronecker.cpp.o"
+  "CMakeFiles/test_matrix_kronecker.dir/test_matrix_kronecker.cpp.o.d"
+  "test_matrix_kronecker"
+  "test_matrix_kronecker.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_kronecker.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
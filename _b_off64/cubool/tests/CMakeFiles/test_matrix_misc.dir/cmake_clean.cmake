@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_matrix_misc.dir/test_matrix_misc.cpp.o"
+  "CMakeFiles/test_matrix_misc.dir/test_matrix_misc.cpp.o.d"
+  "test_matrix_misc"
+  "test_matrix_misc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_misc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_matrix_mtx.dir/test_matrix_mtx.cpp.o"
+  "CMakeFiles/test_matrix_mtx.dir/test_matrix_mtx.cpp.o.d"
+  "test_matrix_mtx"
+  "test_matrix_mtx.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_mtx.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
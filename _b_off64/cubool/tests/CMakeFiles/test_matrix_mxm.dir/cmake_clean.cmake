@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_matrix_mxm.dir/test_matrix_mxm.cpp.o"
+  "CMakeFiles/test_matrix_mxm.dir/test_matrix_mxm.cpp.o.d"
+  "test_matrix_mxm"
+  "test_matrix_mxm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_mxm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_matrix_mxm_masked.dir/test_matrix_mxm_masked.cpp.o"
+  "CMakeFiles/test_matrix_mxm_masked.dir/test_matrix_mxm_masked.cpp.o.d"
+  "test_matrix_mxm_masked"
+  "test_matrix_mxm_masked.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_mxm_masked.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_matrix_offsets.dir/test_matrix_offsets.cpp.o"
+  "CMakeFiles/test_matrix_offsets.dir/test_matrix_offsets.cpp.o.d"
+  "test_matrix_offsets"
+  "test_matrix_offsets.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_offsets.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_matrix_reduce.dir/test_matrix_reduce.cpp.o"
+  "CMakeFiles/test_matrix_reduce.dir/test_matrix_reduce.cpp.o.d"
+  "test_matrix_reduce"
+  "test_matrix_reduce.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_reduce.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_matrix_setup.dir/test_matrix_setup.cpp.o"
+  "CMakeFiles/test_matrix_setup.dir/test_matrix_setup.cpp.o.d"
+  "test_matrix_setup"
+  "test_matrix_setup.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_setup.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
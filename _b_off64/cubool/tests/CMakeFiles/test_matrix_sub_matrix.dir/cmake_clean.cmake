@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_matrix_sub_matrix.dir/test_matrix_sub_matrix.cpp.o"
+  "CMakeFiles/test_matrix_sub_matrix.dir/test_matrix_sub_matrix.cpp.o.d"
+  "test_matrix_sub_matrix"
+  "test_matrix_sub_matrix.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_sub_matrix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_matrix_transpose.dir/test_matrix_transpose.cpp.o"
+  "CMakeFiles/test_matrix_transpose.dir/test_matrix_transpose.cpp.o.d"
+  "test_matrix_transpose"
+  "test_matrix_transpose.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrix_transpose.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
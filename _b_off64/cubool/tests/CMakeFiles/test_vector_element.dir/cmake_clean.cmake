@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_vector_element.dir/test_vector_element.cpp.o"
+  "CMakeFiles/test_vector_element.dir/test_vector_element.cpp.o.d"
+  "test_vector_element"
+  "test_vector_element.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_vector_element.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
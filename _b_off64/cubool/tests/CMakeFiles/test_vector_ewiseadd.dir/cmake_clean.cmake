@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_vector_ewiseadd.dir/test_vector_ewiseadd.cpp.o"
+  "CMakeFiles/test_vector_ewiseadd.dir/test_vector_ewiseadd.cpp.o.d"
+  "test_vector_ewiseadd"
+  "test_vector_ewiseadd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_vector_ewiseadd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
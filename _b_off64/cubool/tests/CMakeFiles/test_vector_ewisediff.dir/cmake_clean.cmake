@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_vector_ewisediff.dir/test_vector_ewisediff.cpp.o"
+  "CMakeFiles/test_vector_ewisediff.dir/test_vector_ewisediff.cpp.o.d"
+  "test_vector_ewisediff"
+  "test_vector_ewisediff.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_vector_ewisediff.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
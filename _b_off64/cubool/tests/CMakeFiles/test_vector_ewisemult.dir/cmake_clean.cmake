@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_vector_ewisemult.dir/test_vector_ewisemult.cpp.o"
+  "CMakeFiles/test_vector_ewisemult.dir/test_vector_ewisemult.cpp.o.d"
+  "test_vector_ewisemult"
+  "test_vector_ewisemult.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_vector_ewisemult.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
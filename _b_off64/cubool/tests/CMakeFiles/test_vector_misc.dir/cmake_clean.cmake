@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_vector_misc.dir/test_vector_misc.cpp.o"
+  "CMakeFiles/test_vector_misc.dir/test_vector_misc.cpp.o.d"
+  "test_vector_misc"
+  "test_vector_misc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_vector_misc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_vector_mxv.dir/test_vector_mxv.cpp.o"
+  "CMakeFiles/test_vector_mxv.dir/test_vector_mxv.cpp.o.d"
+  "test_vector_mxv"
+  "test_vector_mxv.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_vector_mxv.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_vector_mxv_masked.dir/test_vector_mxv_masked.cpp.o"
+  "CMakeFiles/test_vector_mxv_masked.dir/test_vector_mxv_masked.cpp.o.d"
+  "test_vector_mxv_masked"
+  "test_vector_mxv_masked.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_vector_mxv_masked.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_vector_sub_vector.dir/test_vector_sub_vector.cpp.o"
+  "CMakeFiles/test_vector_sub_vector.dir/test_vector_sub_vector.cpp.o.d"
+  "test_vector_sub_vector"
+  "test_vector_sub_vector.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_vector_sub_vector.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_vector_vxm.dir/test_vector_vxm.cpp.o"
+  "CMakeFiles/test_vector_vxm.dir/test_vector_vxm.cpp.o.d"
+  "test_vector_vxm"
+  "test_vector_vxm.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_vector_vxm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/deps/gtest
+# Build directory: /root/repo/_b_off64/deps/gtest
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("googlemock")